@@ -8,13 +8,16 @@
 #include "AnimStateTransitionNode.h"
 #include "EdGraph/EdGraph.h"
 #include "Engine/Blueprint.h"
+#include "ExportJournalLite.h"
+#include "ExportSchedulerLite.h"
 #include "Exporters/Exporter.h"
-#include "Misc/StringOutputDevice.h"
 #include "UnrealExporter.h"
 #include "Framework/Notifications/NotificationManager.h"
+#include "HAL/FileManager.h"
 #include "MetadataGeneratorLite.h"
-#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Utf8FileOutputDeviceLite.h"
 #include "Widgets/Notifications/SNotificationList.h"
 
 void FBlueprintExporterLite::ExportSelectedAssets(
@@ -23,20 +26,32 @@ void FBlueprintExporterLite::ExportSelectedAssets(
   int32 ExportedCount = 0;
   int32 FailedCount = 0;
 
-  for (const FAssetData &AssetData : SelectedAssets) {
-    UObject *Asset = AssetData.GetAsset();
-    if (!Asset) {
+  // Export what people are working on first so useful context lands early
+  TArray<FAssetData> Queue = SelectedAssets;
+  FExportSchedulerLite::SortByPriority(Queue);
+
+  FScopedSlowTask SlowTask(Queue.Num(), NSLOCTEXT("ContextCoreLite", "Exporting",
+                                                  "[ContextCore Lite] Exporting..."));
+  SlowTask.MakeDialogDelayed(1.0f);
+
+  for (const FAssetData &AssetData : Queue) {
+    SlowTask.EnterProgressFrame(1.0f, FText::FromName(AssetData.AssetName));
+
+    // Only handle Blueprints in Lite version; anything else is still reported so
+    // listeners tracking the batch hear about every asset
+    UBlueprint *Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
+    if (!Blueprint) {
+      OnAssetExported().Broadcast(AssetData, false);
       continue;
     }
 
-    // Only handle Blueprints in Lite version
-    if (UBlueprint *Blueprint = Cast<UBlueprint>(Asset)) {
-      if (ExportBlueprint(Blueprint)) {
-        ExportedCount++;
-      } else {
-        FailedCount++;
-      }
+    const bool bExported = ExportBlueprint(Blueprint);
+    if (bExported) {
+      ExportedCount++;
+    } else {
+      FailedCount++;
     }
+    OnAssetExported().Broadcast(AssetData, bExported);
   }
 
   // Show notification
@@ -52,6 +67,11 @@ void FBlueprintExporterLite::ExportSelectedAssets(
          ExportedCount, FailedCount);
 }
 
+FOnAssetExportedLite &FBlueprintExporterLite::OnAssetExported() {
+  static FOnAssetExportedLite Delegate;
+  return Delegate;
+}
+
 bool FBlueprintExporterLite::ExportBlueprint(UBlueprint *Blueprint) {
   if (!Blueprint) {
     return false;
@@ -65,32 +85,38 @@ bool FBlueprintExporterLite::ExportBlueprint(UBlueprint *Blueprint) {
     PlatformFile.CreateDirectoryTree(*OutputDir);
   }
 
+  const FString AssetPath = Blueprint->GetOutermost()->GetName();
+  TArray<FString> WrittenFiles;
   bool bSuccess = true;
 
+  auto ExportGraphFile = [&](UEdGraph *Graph, const FString &FileName) {
+    if (ExportGraph(Graph, OutputDir, FileName)) {
+      WrittenFiles.Add(FileName);
+    } else {
+      bSuccess = false;
+    }
+  };
+
   // Export all graphs
   // UbergraphPages (EventGraph, etc.)
   for (UEdGraph *Graph : Blueprint->UbergraphPages) {
-    if (!ExportGraph(Graph, OutputDir, Graph->GetName() + TEXT(".txt"))) {
-      bSuccess = false;
-    }
+    ExportGraphFile(Graph, Graph->GetName() + TEXT(".txt"));
   }
 
   // Function graphs
   for (UEdGraph *Graph : Blueprint->FunctionGraphs) {
-    if (!ExportGraph(Graph, OutputDir, TEXT("Function_") + Graph->GetName() + TEXT(".txt"))) {
-      bSuccess = false;
-    }
+    ExportGraphFile(Graph, TEXT("Function_") + Graph->GetName() + TEXT(".txt"));
   }
 
   // Macro graphs
   for (UEdGraph *Graph : Blueprint->MacroGraphs) {
-    if (!ExportGraph(Graph, OutputDir, TEXT("Macro_") + Graph->GetName() + TEXT(".txt"))) {
-      bSuccess = false;
-    }
+    ExportGraphFile(Graph, TEXT("Macro_") + Graph->GetName() + TEXT(".txt"));
   }
 
   // Generate metadata JSON
-  if (!GenerateMetadata(Blueprint, OutputDir)) {
+  if (GenerateMetadata(Blueprint, OutputDir)) {
+    WrittenFiles.Add(TEXT("_meta.json"));
+  } else {
     bSuccess = false;
   }
 
@@ -102,10 +128,10 @@ bool FBlueprintExporterLite::ExportBlueprint(UBlueprint *Blueprint) {
           if (UAnimGraphNode_StateMachine *SMNode = Cast<UAnimGraphNode_StateMachine>(Node)) {
             FString SMName = SMNode->GetNodeTitle(ENodeTitleType::ListView).ToString();
             FString SafeName = SanitizeFileName(SMName);
-            
+
             if (SMNode->EditorStateMachineGraph) {
-              ExportGraph(Cast<UEdGraph>(SMNode->EditorStateMachineGraph.Get()), OutputDir,
-                         TEXT("StateMachine_") + SafeName + TEXT(".txt"));
+              ExportGraphFile(Cast<UEdGraph>(SMNode->EditorStateMachineGraph.Get()),
+                              TEXT("StateMachine_") + SafeName + TEXT(".txt"));
             }
           }
         }
@@ -113,6 +139,16 @@ bool FBlueprintExporterLite::ExportBlueprint(UBlueprint *Blueprint) {
     }
   }
 
+  // Journal what changed for downstream incremental ingestion
+  for (const FString &FileName : WrittenFiles) {
+    FExportJournalLite::RecordWrite(AssetPath, OutputDir / FileName);
+  }
+
+  // Only prune when every graph made it out, otherwise we'd delete a failed graph's last good copy
+  if (bSuccess) {
+    RemoveStaleOutputs(AssetPath, OutputDir, WrittenFiles);
+  }
+
   UE_LOG(LogTemp, Log, TEXT("[ContextCore Lite] Exported: %s"), *Blueprint->GetName());
   return bSuccess;
 }
@@ -133,14 +169,21 @@ bool FBlueprintExporterLite::ExportGraph(UEdGraph *Graph, const FString &OutputD
     return false;
   }
 
-  FStringOutputDevice Archive;
+  // Stream UTF-8 straight to disk so huge graphs never sit in memory as one string.
+  // Write to a temp file first so a failed export never clobbers the last good copy.
+  const FString OutputPath = OutputDir / FileName;
+  const FString TempPath = OutputPath + TEXT(".tmp");
+  FUtf8FileOutputDeviceLite Archive(TempPath);
+  if (!Archive.IsOpen()) {
+    return false;
+  }
+
   const FExportObjectInnerContext Context;
 
-  // Export header comment
+  // Export header comment (no timestamp, so unchanged graphs hash the same across exports)
   Archive.Logf(TEXT("// Graph: %s\n"), *Graph->GetName());
   Archive.Logf(TEXT("// Type: %s\n"), *Graph->GetClass()->GetName());
   Archive.Logf(TEXT("// Node Count: %d\n"), Graph->Nodes.Num());
-  Archive.Logf(TEXT("// Exported: %s\n"), *FDateTime::Now().ToString(TEXT("%Y.%m.%d-%H.%M.%S")));
   Archive.Logf(TEXT("\n"));
 
   // Export each node in T3D format
@@ -149,9 +192,11 @@ bool FBlueprintExporterLite::ExportGraph(UEdGraph *Graph, const FString &OutputD
                                     PPF_ExportsNotFullyQualified | PPF_Copy | PPF_Delimited);
   }
 
-  FString OutputPath = OutputDir / FileName;
-  return FFileHelper::SaveStringToFile(
-      Archive, *OutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+  if (!Archive.Close() || !IFileManager::Get().Move(*OutputPath, *TempPath, true, true)) {
+    IFileManager::Get().Delete(*TempPath);
+    return false;
+  }
+  return true;
 }
 
 bool FBlueprintExporterLite::GenerateMetadata(UBlueprint *Blueprint,
@@ -159,6 +204,25 @@ bool FBlueprintExporterLite::GenerateMetadata(UBlueprint *Blueprint,
   return FMetadataGeneratorLite::GenerateMetadataForBlueprint(Blueprint, OutputDir);
 }
 
+void FBlueprintExporterLite::RemoveStaleOutputs(const FString &AssetPath,
+                                                const FString &OutputDir,
+                                                const TArray<FString> &WrittenFiles) {
+  // Graphs that were renamed or removed since the last export leave orphaned files behind
+  TArray<FString> ExistingFiles;
+  IFileManager::Get().FindFiles(ExistingFiles, *(OutputDir / TEXT("*.txt")), true, false);
+
+  for (const FString &FileName : ExistingFiles) {
+    if (WrittenFiles.Contains(FileName)) {
+      continue;
+    }
+
+    const FString FilePath = OutputDir / FileName;
+    if (IFileManager::Get().Delete(*FilePath)) {
+      FExportJournalLite::RecordDelete(AssetPath, FilePath);
+    }
+  }
+}
+
 FString FBlueprintExporterLite::SanitizeFileName(const FString &Name) {
   FString SafeName = Name;
   SafeName.ReplaceInline(TEXT("/"), TEXT("_"));
@@ -0,0 +1,199 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExportJournalLite.h"
+#include "BlueprintExporterLite.h"
+#include "HAL/FileManager.h"
+#include "Json.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+
+namespace {
+// Don't bother compacting small journals
+constexpr int32 CompactionMinRecords = 4096;
+
+bool bJournalLoaded = false;
+int64 LatestSequence = 0;
+int32 RecordCount = 0;
+TMap<FString, FExportJournalEntry> LatestByFile;
+} // namespace
+
+void FExportJournalLite::RecordWrite(const FString &AssetPath, const FString &FilePath) {
+  EnsureLoaded();
+
+  const FMD5Hash FileHash = FMD5Hash::HashFile(*FilePath);
+  if (!FileHash.IsValid()) {
+    return;
+  }
+  const FString Hash = LexToString(FileHash);
+
+  // Re-exporting unchanged content is not a change
+  const FExportJournalEntry *Previous = LatestByFile.Find(ToRelativePath(FilePath));
+  if (Previous && Previous->Reason != TEXT("deleted") && Previous->Hash == Hash) {
+    return;
+  }
+
+  AppendEntry(AssetPath, FilePath, Hash,
+              (Previous && Previous->Reason != TEXT("deleted")) ? TEXT("modified")
+                                                                : TEXT("created"));
+}
+
+void FExportJournalLite::RecordDelete(const FString &AssetPath, const FString &FilePath) {
+  EnsureLoaded();
+  AppendEntry(AssetPath, FilePath, FString(), TEXT("deleted"));
+}
+
+void FExportJournalLite::GetChangesSince(int64 Sequence,
+                                         TArray<FExportJournalEntry> &OutEntries) {
+  TArray<FString> Lines;
+  FFileHelper::LoadFileToStringArray(Lines, *GetJournalPath());
+
+  for (const FString &Line : Lines) {
+    FExportJournalEntry Entry;
+    if (ParseJsonLine(Line, Entry) && Entry.Sequence > Sequence) {
+      OutEntries.Add(MoveTemp(Entry));
+    }
+  }
+
+  OutEntries.Sort([](const FExportJournalEntry &A, const FExportJournalEntry &B) {
+    return A.Sequence < B.Sequence;
+  });
+}
+
+int64 FExportJournalLite::GetLatestSequence() {
+  EnsureLoaded();
+  return LatestSequence;
+}
+
+bool FExportJournalLite::Compact() {
+  EnsureLoaded();
+
+  // Keep the latest entry per file (deletes included) so "changes since N" stays correct
+  TArray<FExportJournalEntry> Entries;
+  LatestByFile.GenerateValueArray(Entries);
+  Entries.Sort([](const FExportJournalEntry &A, const FExportJournalEntry &B) {
+    return A.Sequence < B.Sequence;
+  });
+
+  FString Output;
+  for (const FExportJournalEntry &Entry : Entries) {
+    Output += EntryToJsonLine(Entry);
+    Output += TEXT("\n");
+  }
+
+  const FString JournalPath = GetJournalPath();
+  const FString TempPath = JournalPath + TEXT(".tmp");
+  if (!FFileHelper::SaveStringToFile(Output, *TempPath,
+                                     FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)) {
+    return false;
+  }
+  if (!IFileManager::Get().Move(*JournalPath, *TempPath, true, true)) {
+    IFileManager::Get().Delete(*TempPath);
+    return false;
+  }
+
+  RecordCount = Entries.Num();
+  UE_LOG(LogTemp, Log, TEXT("[ContextCore Lite] Journal compacted to %d entries"), RecordCount);
+  return true;
+}
+
+void FExportJournalLite::EnsureLoaded() {
+  if (bJournalLoaded) {
+    return;
+  }
+  bJournalLoaded = true;
+
+  TArray<FString> Lines;
+  FFileHelper::LoadFileToStringArray(Lines, *GetJournalPath());
+
+  for (const FString &Line : Lines) {
+    FExportJournalEntry Entry;
+    if (!ParseJsonLine(Line, Entry)) {
+      continue;
+    }
+    RecordCount++;
+    LatestSequence = FMath::Max(LatestSequence, Entry.Sequence);
+
+    FExportJournalEntry &Latest = LatestByFile.FindOrAdd(Entry.File);
+    if (Entry.Sequence >= Latest.Sequence) {
+      Latest = MoveTemp(Entry);
+    }
+  }
+}
+
+void FExportJournalLite::AppendEntry(const FString &AssetPath, const FString &FilePath,
+                                     const FString &Hash, const FString &Reason) {
+  FExportJournalEntry Entry;
+  Entry.Sequence = LatestSequence + 1;
+  Entry.AssetPath = AssetPath;
+  Entry.File = ToRelativePath(FilePath);
+  Entry.Hash = Hash;
+  Entry.Reason = Reason;
+
+  const FString JournalPath = GetJournalPath();
+  if (!FFileHelper::SaveStringToFile(EntryToJsonLine(Entry) + TEXT("\n"), *JournalPath,
+                                     FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM,
+                                     &IFileManager::Get(), FILEWRITE_Append)) {
+    UE_LOG(LogTemp, Warning, TEXT("[ContextCore Lite] Failed to append to journal: %s"),
+           *JournalPath);
+    return;
+  }
+
+  LatestSequence = Entry.Sequence;
+  RecordCount++;
+  LatestByFile.Add(Entry.File, MoveTemp(Entry));
+
+  if (RecordCount > CompactionMinRecords && RecordCount > LatestByFile.Num() * 2) {
+    Compact();
+  }
+}
+
+FString FExportJournalLite::EntryToJsonLine(const FExportJournalEntry &Entry) {
+  TSharedRef<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+  EntryObj->SetNumberField(TEXT("seq"), static_cast<double>(Entry.Sequence));
+  EntryObj->SetStringField(TEXT("asset"), Entry.AssetPath);
+  EntryObj->SetStringField(TEXT("file"), Entry.File);
+  EntryObj->SetStringField(TEXT("hash"), Entry.Hash);
+  EntryObj->SetStringField(TEXT("reason"), Entry.Reason);
+
+  FString Line;
+  TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+      TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Line);
+  FJsonSerializer::Serialize(EntryObj, Writer);
+  return Line;
+}
+
+bool FExportJournalLite::ParseJsonLine(const FString &Line, FExportJournalEntry &OutEntry) {
+  if (Line.IsEmpty()) {
+    return false;
+  }
+
+  TSharedPtr<FJsonObject> EntryObj;
+  TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(Line);
+  if (!FJsonSerializer::Deserialize(Reader, EntryObj) || !EntryObj.IsValid()) {
+    return false;
+  }
+
+  double Sequence = 0.0;
+  if (!EntryObj->TryGetNumberField(TEXT("seq"), Sequence) ||
+      !EntryObj->TryGetStringField(TEXT("file"), OutEntry.File)) {
+    return false;
+  }
+  OutEntry.Sequence = static_cast<int64>(Sequence);
+  EntryObj->TryGetStringField(TEXT("asset"), OutEntry.AssetPath);
+  EntryObj->TryGetStringField(TEXT("hash"), OutEntry.Hash);
+  EntryObj->TryGetStringField(TEXT("reason"), OutEntry.Reason);
+  return true;
+}
+
+FString FExportJournalLite::GetJournalPath() {
+  return FBlueprintExporterLite::GetOutputDirectory() / TEXT("_journal.jsonl");
+}
+
+FString FExportJournalLite::ToRelativePath(const FString &FilePath) {
+  FString RelativePath = FPaths::ConvertRelativePathToFull(FilePath);
+  FPaths::MakePathRelativeTo(
+      RelativePath,
+      *(FPaths::ConvertRelativePathToFull(FBlueprintExporterLite::GetOutputDirectory()) + TEXT("/")));
+  return RelativePath;
+}
@@ -0,0 +1,96 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ExportSchedulerLite.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
+#include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+
+namespace {
+// Packages saved within this window count as "recently modified"
+const FTimespan RecentlyModifiedWindow = FTimespan::FromHours(24.0);
+} // namespace
+
+void FExportSchedulerLite::SortByPriority(TArray<FAssetData> &Assets) {
+  if (Assets.Num() < 2) {
+    return;
+  }
+
+  const TSet<FName> EditedPackages = GetEditedPackages();
+  IAssetRegistry &AssetRegistry =
+      FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+  TMap<FName, FAssetPriority> Priorities;
+  Priorities.Reserve(Assets.Num());
+  for (const FAssetData &AssetData : Assets) {
+    if (!Priorities.Contains(AssetData.PackageName)) {
+      Priorities.Add(AssetData.PackageName,
+                     ComputePriority(AssetData, EditedPackages, AssetRegistry));
+    }
+  }
+
+  const FDateTime RecentThreshold = FDateTime::UtcNow() - RecentlyModifiedWindow;
+
+  Assets.StableSort([&Priorities, &RecentThreshold](const FAssetData &A, const FAssetData &B) {
+    const FAssetPriority &PA = Priorities.FindChecked(A.PackageName);
+    const FAssetPriority &PB = Priorities.FindChecked(B.PackageName);
+
+    if (PA.bActive != PB.bActive) {
+      return PA.bActive;
+    }
+
+    const bool bRecentA = PA.ModifiedTime >= RecentThreshold;
+    const bool bRecentB = PB.ModifiedTime >= RecentThreshold;
+    if (bRecentA != bRecentB) {
+      return bRecentA;
+    }
+    if (bRecentA && PA.ModifiedTime != PB.ModifiedTime) {
+      return PA.ModifiedTime > PB.ModifiedTime;
+    }
+
+    return PA.ReferencerCount > PB.ReferencerCount;
+  });
+}
+
+FExportSchedulerLite::FAssetPriority
+FExportSchedulerLite::ComputePriority(const FAssetData &AssetData,
+                                      const TSet<FName> &EditedPackages,
+                                      IAssetRegistry &AssetRegistry) {
+  FAssetPriority Priority;
+  const FString PackageName = AssetData.PackageName.ToString();
+
+  // Open in an editor or holding unsaved changes
+  UPackage *Package = FindPackage(nullptr, *PackageName);
+  Priority.bActive =
+      EditedPackages.Contains(AssetData.PackageName) || (Package && Package->IsDirty());
+
+  FString PackageFile;
+  if (FPackageName::DoesPackageExist(PackageName, &PackageFile)) {
+    Priority.ModifiedTime = IFileManager::Get().GetTimeStamp(*PackageFile);
+  }
+
+  TArray<FName> Referencers;
+  AssetRegistry.GetReferencers(AssetData.PackageName, Referencers);
+  Priority.ReferencerCount = Referencers.Num();
+
+  return Priority;
+}
+
+TSet<FName> FExportSchedulerLite::GetEditedPackages() {
+  TSet<FName> EditedPackages;
+  if (!GEditor) {
+    return EditedPackages;
+  }
+
+  if (UAssetEditorSubsystem *AssetEditorSubsystem =
+          GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()) {
+    for (UObject *EditedAsset : AssetEditorSubsystem->GetAllEditedAssets()) {
+      if (EditedAsset) {
+        EditedPackages.Add(EditedAsset->GetOutermost()->GetFName());
+      }
+    }
+  }
+
+  return EditedPackages;
+}
@@ -0,0 +1,53 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Utf8FileOutputDeviceLite.h"
+#include "HAL/FileManager.h"
+
+FUtf8FileOutputDeviceLite::FUtf8FileOutputDeviceLite(const FString &InFilePath)
+    : FileWriter(IFileManager::Get().CreateFileWriter(*InFilePath)) {
+  bAutoEmitLineTerminator = false;
+  Buffer.Reserve(ChunkSize);
+}
+
+FUtf8FileOutputDeviceLite::~FUtf8FileOutputDeviceLite() { Close(); }
+
+bool FUtf8FileOutputDeviceLite::Close() {
+  if (!FileWriter.IsValid()) {
+    return false;
+  }
+
+  Flush();
+  const bool bSuccess = FileWriter->Close() && !FileWriter->IsError();
+  FileWriter.Reset();
+  return bSuccess;
+}
+
+void FUtf8FileOutputDeviceLite::Serialize(const TCHAR *Data, ELogVerbosity::Type Verbosity,
+                                          const FName &Category) {
+  if (!FileWriter.IsValid() || !Data) {
+    return;
+  }
+
+  // Each call carries whole strings, so surrogate pairs are never split across conversions
+  FTCHARToUTF8 Utf8(Data);
+  const uint8 *Bytes = reinterpret_cast<const uint8 *>(Utf8.Get());
+  int32 Remaining = Utf8.Length();
+
+  while (Remaining > 0) {
+    const int32 Count = FMath::Min(Remaining, ChunkSize - Buffer.Num());
+    Buffer.Append(Bytes, Count);
+    Bytes += Count;
+    Remaining -= Count;
+
+    if (Buffer.Num() >= ChunkSize) {
+      Flush();
+    }
+  }
+}
+
+void FUtf8FileOutputDeviceLite::Flush() {
+  if (FileWriter.IsValid() && Buffer.Num() > 0) {
+    FileWriter->Serialize(Buffer.GetData(), Buffer.Num());
+    Buffer.Reset();
+  }
+}
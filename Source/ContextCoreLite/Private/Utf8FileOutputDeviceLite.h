@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/OutputDevice.h"
+
+/**
+ * Output device that encodes text to UTF-8 and streams it to a file in fixed-size chunks,
+ * so memory use stays bounded no matter how much is exported through it
+ */
+class FUtf8FileOutputDeviceLite : public FOutputDevice {
+public:
+  explicit FUtf8FileOutputDeviceLite(const FString &InFilePath);
+  virtual ~FUtf8FileOutputDeviceLite();
+
+  /** True if the file was opened successfully */
+  bool IsOpen() const { return FileWriter.IsValid(); }
+
+  /** Flush remaining data and close the file. Returns false if any write failed. */
+  bool Close();
+
+  // FOutputDevice interface
+  virtual void Serialize(const TCHAR *Data, ELogVerbosity::Type Verbosity,
+                         const FName &Category) override;
+  virtual void Flush() override;
+
+private:
+  static constexpr int32 ChunkSize = 64 * 1024;
+
+  TUniquePtr<FArchive> FileWriter;
+  TArray<uint8> Buffer;
+};
@@ -8,21 +8,34 @@
 class UBlueprint;
 class UEdGraph;
 
+/**
+ * Fired as soon as each asset's output is on disk (asset, success).
+ * Assets that fail to load or are not Blueprints are skipped and reported with success = false.
+ */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnAssetExportedLite, const FAssetData &, bool);
+
 /**
  * Lite version exporter - single Blueprint only, no recursive dependencies
  */
 class CONTEXTCORELITE_API FBlueprintExporterLite {
 public:
-  /** Export selected Blueprints (no dependency recursion) */
+  /** Export selected Blueprints (no dependency recursion), highest priority first */
   static void ExportSelectedAssets(const TArray<FAssetData> &SelectedAssets);
 
+  /** Per-asset readiness, broadcast during ExportSelectedAssets */
+  static FOnAssetExportedLite &OnAssetExported();
+
   /** Export a single Blueprint */
   static bool ExportBlueprint(UBlueprint *Blueprint);
 
-private:
+  /** Root of all exported files (Docs/.context) */
   static FString GetOutputDirectory();
+
+private:
   static FString GetBlueprintOutputPath(UBlueprint *Blueprint);
   static bool ExportGraph(UEdGraph *Graph, const FString &OutputDir, const FString &FileName);
   static bool GenerateMetadata(UBlueprint *Blueprint, const FString &OutputDir);
+  static void RemoveStaleOutputs(const FString &AssetPath, const FString &OutputDir,
+                                 const TArray<FString> &WrittenFiles);
   static FString SanitizeFileName(const FString &Name);
 };
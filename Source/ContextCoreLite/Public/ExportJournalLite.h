@@ -0,0 +1,47 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A single change record in the export journal
+ */
+struct CONTEXTCORELITE_API FExportJournalEntry {
+  int64 Sequence = 0;
+  FString AssetPath;
+  FString File;
+  FString Hash;
+  FString Reason;
+};
+
+/**
+ * Append-only journal of every file the exporter writes or deletes under Docs/.context/.
+ * Stored as JSON lines in _journal.jsonl so downstream jobs can ingest only what changed.
+ */
+class CONTEXTCORELITE_API FExportJournalLite {
+public:
+  /** Record a written file. Skipped if its content hash matches the last recorded one. */
+  static void RecordWrite(const FString &AssetPath, const FString &FilePath);
+
+  /** Record a deleted file */
+  static void RecordDelete(const FString &AssetPath, const FString &FilePath);
+
+  /** Collect all entries with a sequence number greater than Sequence, in order */
+  static void GetChangesSince(int64 Sequence, TArray<FExportJournalEntry> &OutEntries);
+
+  /** Highest sequence number recorded so far (0 if the journal is empty) */
+  static int64 GetLatestSequence();
+
+  /** Rewrite the journal keeping only the latest entry per file */
+  static bool Compact();
+
+private:
+  static void EnsureLoaded();
+  static void AppendEntry(const FString &AssetPath, const FString &FilePath,
+                          const FString &Hash, const FString &Reason);
+  static FString EntryToJsonLine(const FExportJournalEntry &Entry);
+  static bool ParseJsonLine(const FString &Line, FExportJournalEntry &OutEntry);
+  static FString GetJournalPath();
+  static FString ToRelativePath(const FString &FilePath);
+};
@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "AssetRegistry/AssetData.h"
+#include "CoreMinimal.h"
+
+class IAssetRegistry;
+
+/**
+ * Orders an export batch so the assets people are working on are exported first
+ */
+class CONTEXTCORELITE_API FExportSchedulerLite {
+public:
+  /**
+   * Sort assets by priority, highest first:
+   * open in an editor or unsaved, then recently modified (newest first),
+   * then by number of referencers in the AssetRegistry
+   */
+  static void SortByPriority(TArray<FAssetData> &Assets);
+
+private:
+  struct FAssetPriority {
+    bool bActive = false;
+    FDateTime ModifiedTime = FDateTime::MinValue();
+    int32 ReferencerCount = 0;
+  };
+
+  static FAssetPriority ComputePriority(const FAssetData &AssetData,
+                                        const TSet<FName> &EditedPackages,
+                                        IAssetRegistry &AssetRegistry);
+  static TSet<FName> GetEditedPackages();
+};